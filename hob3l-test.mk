@@ -227,10 +227,17 @@ TEST_STL.scad := \
     test/hob3l/test39b.scad \
     test/hob3l/test42a.scad \
     test/hob3l/test42b.scad \
+    test/hob3l/test42c.scad \
     test/hob3l/test37b.scad \
     test/hob3l/test38.scad \
     test/hob3l/ergo.scad
 
+TEST_MESH.scad := \
+    test/hob3l/corner17.scad \
+    test/hob3l/test2.scad \
+    test/hob3l/test31b.scad \
+    test/hob3l/curry.scad
+
 # The following tests currently fail:
 #   - test43  (FONT) triggers another orientation bug due to rounding in the bool algo
 #   - test43b (FONT) the same (test43 is the smaller file for debugging)
@@ -262,6 +269,40 @@ TEST_STL.stl := \
 TEST_STL.jsgz := \
     $(addprefix out/test/hob3l/,$(notdir $(TEST_STL.scad:.scad=.js.gz)))
 
+TEST_MESH.ply := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.ply)))
+
+TEST_MESH.obj := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.obj)))
+
+TEST_MESH.3mf := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.3mf)))
+
+TEST_MESH.compactjs := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.compact.js)))
+
+# Output compared with a reference file in test/hob3l/ref/.  The files
+# are generated with the same command as the output, but need to be
+# checked manually when they change.
+TEST_JSREF := \
+    out/test/hob3l/test1b.compact.js.ok \
+    out/test/hob3l/test1b.bin.js.ok
+
+TEST_MESH.parstl := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.par.stl)))
+
+TEST_MESH.cachestl := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.cache.stl)))
+
+TEST_MESH.layercachestl := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.layercache.stl)))
+
+TEST_MESH.stats := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.stats.json)))
+
+TEST_MESH.stl := \
+    $(addprefix out/test/hob3l/,$(notdir $(TEST_MESH.scad:.scad=.stl)))
+
 FAIL_TRIANGLE := \
     $(addprefix out/test/hob3l/fail-,$(notdir $(FAIL_TRIANGLE.scad:.scad=.ps)))
 
@@ -285,7 +326,15 @@ no-unit-test-hob3l: \
     test-hob3l-triangle \
     test-hob3l-triangle-prepare \
     test-hob3l-stl \
-    test-hob3l-js
+    test-hob3l-mesh \
+    test-hob3l-js \
+    test-hob3l-js-compact \
+    test-hob3l-js-ref \
+    test-hob3l-stl-par \
+    test-hob3l-stl-cache \
+    test-hob3l-stl-layer-cache \
+    test-hob3l-stl-batch \
+    test-hob3l-stl-stats
 
 fail: fail-hob3l
 fail-hob3l: \
@@ -302,6 +351,30 @@ test-hob3l-stl: $(TEST_STL.stl)
 .PHONY: test-hob3l-js
 test-hob3l-js: $(TEST_STL.jsgz)
 
+.PHONY: test-hob3l-stl-par
+test-hob3l-stl-par: $(TEST_MESH.parstl)
+
+.PHONY: test-hob3l-stl-cache
+test-hob3l-stl-cache: $(TEST_MESH.cachestl)
+
+.PHONY: test-hob3l-stl-layer-cache
+test-hob3l-stl-layer-cache: $(TEST_MESH.layercachestl)
+
+.PHONY: test-hob3l-stl-batch
+test-hob3l-stl-batch: out/test/hob3l/batch.stamp
+
+.PHONY: test-hob3l-stl-stats
+test-hob3l-stl-stats: $(TEST_MESH.stats)
+
+.PHONY: test-hob3l-js-compact
+test-hob3l-js-compact: $(TEST_MESH.compactjs)
+
+.PHONY: test-hob3l-js-ref
+test-hob3l-js-ref: $(TEST_JSREF)
+
+.PHONY: test-hob3l-mesh
+test-hob3l-mesh: $(TEST_MESH.ply) $(TEST_MESH.obj) $(TEST_MESH.3mf)
+
 
 .PHONY: fail-hob3l-triangle
 fail-hob3l-triangle: $(FAIL_TRIANGLE)
@@ -335,6 +408,79 @@ out/test/hob3l/%.stl: test/hob3l/%.scad hob3l.x
 	$(HOB3L) $< -o $@.new.stl
 	mv $@.new.stl $@
 
+# out/test/hob3l/%.SUFFIX.stl: run with STL_OPT.SUFFIX, which may use
+# $@.cache as a cache directory, and compare with the plain STL.  The
+# second run reads from the cache, or checks that the result is
+# repeatable.
+STL_OPT.par = --threads=4
+STL_OPT.cache = --cache-dir=$@.cache
+STL_OPT.layercache = --cache-dir=$@.cache --cache-layers
+
+define STL_SAME
+out/test/hob3l/%.$(1).stl: test/hob3l/%.scad out/test/hob3l/%.stl hob3l.x
+	rm -rf $$@.cache
+	$$(HOB3L) $$< $$(STL_OPT.$(1)) -o $$@.new.stl
+	cmp $$@.new.stl out/test/hob3l/$$*.stl
+	$$(HOB3L) $$< $$(STL_OPT.$(1)) -o $$@.new.stl
+	cmp $$@.new.stl out/test/hob3l/$$*.stl
+	rm -rf $$@.cache
+	mv $$@.new.stl $$@
+endef
+
+$(foreach s,par cache layercache,$(eval $(call STL_SAME,$(s))))
+
+out/test/hob3l/batch.stamp: $(TEST_MESH.scad) $(TEST_MESH.stl) hob3l.x
+	rm -rf out/test/hob3l/batch
+	mkdir -p out/test/hob3l/batch
+	$(HOB3L) --jobs=4 $(TEST_MESH.scad) -o 'out/test/hob3l/batch/%s.stl'
+	for f in $(notdir $(TEST_MESH.stl)); do \
+	    cmp out/test/hob3l/batch/$$f out/test/hob3l/$$f || exit 1; \
+	done
+	touch $@
+
+out/test/hob3l/%.stats.json: test/hob3l/%.scad out/test/hob3l/%.stl hob3l.x
+	$(HOB3L) $< -q --stats=json --profile-objects=3 --trace=$@.trace -o $@.stl 2>$@.new
+	cmp $@.stl out/test/hob3l/$*.stl
+	grep -q '^{"file":.*"tri":[0-9]' $@.new
+	grep -q '^Profile: top ' $@.new
+	grep -q '"cat":"file"' $@.trace
+	tail -n 1 $@.trace | grep -q '^]}$$'
+	rm -f $@.stl $@.trace
+	mv $@.new $@
+
+out/test/hob3l/%.compact.js: test/hob3l/%.scad hob3l.x
+	$(HOB3L) $< --js-compact -o $@.new.js
+	mv $@.new.js $@
+
+# The name of the .bin file is stored in the .js file, so this is
+# written in place.
+out/test/hob3l/%.bin.js: test/hob3l/%.scad hob3l.x
+	$(HOB3L) $< --js-bin -o $@
+
+out/test/hob3l/%.js.ok: out/test/hob3l/%.js test/hob3l/ref/%.js
+	cmp out/test/hob3l/$*.js test/hob3l/ref/$*.js
+	touch $@
+
+out/test/hob3l/%.bin.js.ok: out/test/hob3l/%.bin.js test/hob3l/ref/%.bin.js test/hob3l/ref/%.bin.bin
+	cmp out/test/hob3l/$*.bin.js test/hob3l/ref/$*.bin.js
+	cmp out/test/hob3l/$*.bin.bin test/hob3l/ref/$*.bin.bin
+	touch $@
+
+out/test/hob3l/%.ply: test/hob3l/%.scad out/test/hob3l/%.stl hob3l.x script/meshcmp
+	$(HOB3L) $< -o $@.new.ply
+	./script/meshcmp $@.new.ply out/test/hob3l/$*.stl
+	mv $@.new.ply $@
+
+out/test/hob3l/%.obj: test/hob3l/%.scad out/test/hob3l/%.stl hob3l.x script/meshcmp
+	$(HOB3L) $< -o $@.new.obj
+	./script/meshcmp $@.new.obj out/test/hob3l/$*.stl
+	mv $@.new.obj $@
+
+out/test/hob3l/%.3mf: test/hob3l/%.scad out/test/hob3l/%.stl hob3l.x script/meshcmp
+	$(HOB3L) $< -o $@.new.3mf
+	./script/meshcmp $@.new.3mf out/test/hob3l/$*.stl
+	mv $@.new.3mf $@
+
 out/test/hob3l/fail-%.stl: test/hob3l/%.scad hob3l.x
 	! $(MAKE) out/test/hob3l/$*.stl
 	echo >| $@
@@ -385,6 +531,46 @@ SCAD_SCAD := $(wildcard $(SCAD_DIR)/*.scad)
 .PHONY: test-hob3l-scad
 test-hob3l-scad: $(addprefix out/test/hob3l/,$(notdir $(SCAD_SCAD:.scad=.stl)))
 
+# Benchmark: time each model BENCH_RUNS times and write the results
+# to out/bench/result.json.  With BENCH_REF=FILE, the median times are
+# compared with a previous result file.  Use MODE=release for numbers
+# that are comparable between releases.
+BENCH_RUNS := 3
+BENCH_HOLES := 20
+BENCH_REF :=
+
+BENCH_MODEL := \
+    test/hob3l/curry.scad \
+    test/hob3l/ergo.scad \
+    out/bench/holes.scad \
+    out/bench/deep.scad \
+    out/bench/spheres.scad \
+    out/bench/mesh.scad
+
+# The text model is empty without glyph data, so it is only part of
+# the corpus with WITH_FONT=1.
+BENCH_TEXT :=
+ifeq ($(WITH_FONT),1)
+BENCH_TEXT := --text
+BENCH_MODEL += out/bench/text.scad
+endif
+
+bench: bench-hob3l
+
+.PHONY: bench-hob3l
+bench-hob3l: hob3l.x out/bench/model$(BENCH_TEXT:--%=-%).stamp
+	$(srcdir)/script/bench \
+	    --runs=$(BENCH_RUNS) \
+	    --out=out/bench/result.json \
+	    --build='OPT=$(OPT) NDEBUG=$(NDEBUG) ARCH=$(ARCH) SANITIZE=$(SANITIZE) TARGET=$(TARGET)' \
+	    $(BENCH_REF:%=--ref=%) \
+	    $(HOB3L) $(BENCH_MODEL)
+
+out/bench/model$(BENCH_TEXT:--%=-%).stamp: $(srcdir)/script/mkbench
+	rm -f out/bench/model*.stamp
+	$(srcdir)/script/mkbench --holes=$(BENCH_HOLES) $(BENCH_TEXT) out/bench
+	touch $@
+
 speed-test: speed-test-hob3l
 speed-test-hob3l:
 	rm -f .mode.d.old && mv .mode.d .mode.d.old
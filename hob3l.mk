@@ -42,17 +42,22 @@ MOD_C.libhob3l.a := \
     hob3l/scad-2scad.c \
     hob3l/csg3.c \
     hob3l/csg3-2scad.c \
+    hob3l/csg3-cache.c \
     hob3l/csg2.c \
     hob3l/csg2-tree.c \
     hob3l/csg2-layer.c \
+    hob3l/csg2-cache.c \
     hob3l/csg2-bool.c \
     hob3l/csg2-hull.c \
     hob3l/csg2-2scad.c \
     hob3l/csg2-2stl.c \
+    hob3l/csg2-2mesh.c \
     hob3l/csg2-2js.c \
     hob3l/csg2-2ps.c \
     hob3l/ps.c \
-    hob3l/gc.c
+    hob3l/gc.c \
+    hob3l/stats.c \
+    hob3l/timeline.c
 
 MOD_O.libhob3l.a := $(addprefix out/bin/,$(MOD_C.libhob3l.a:.c=.o))
 MOD_D.libhob3l.a := $(addprefix out/bin/,$(MOD_C.libhob3l.a:.c=.d))
@@ -81,6 +86,7 @@ _ := $(shell mkdir -p out/bin/hob3l)
 _ := $(shell mkdir -p out/src/hob3l)
 _ := $(shell mkdir -p out/share)
 _ := $(shell mkdir -p out/speed)
+_ := $(shell mkdir -p out/bench)
 
 -include out/bin/hob3l/*.d
 
@@ -16,7 +16,12 @@ MOD_C.libhob3lbase.a := \
     hob3lbase/dict.c \
     hob3lbase/list.c \
     hob3lbase/stream.c \
+    hob3lbase/fmt.c \
+    hob3lbase/scan.c \
+    hob3lbase/hash.c \
+    hob3lbase/par.c \
     hob3lbase/pool.c \
+    hob3lbase/arena.c \
     hob3lbase/vchar.c \
     hob3lbase/panic.c \
     hob3lbase/qsort.c \
@@ -31,7 +36,11 @@ MOD_D.libhob3lbase.a := $(addprefix out/bin/,$(MOD_C.libhob3lbase.a:.c=.d))
 MOD_C.libhob3lbase-test.a := \
     hob3lbase/hob3lbase-test.c \
     hob3lbase/dict-test.c \
-    hob3lbase/list-test.c
+    hob3lbase/list-test.c \
+    hob3lbase/fmt-test.c \
+    hob3lbase/scan-test.c \
+    hob3lbase/hash-test.c \
+    hob3lbase/arena-test.c
 
 MOD_O.libhob3lbase-test.a := $(addprefix out/bin/,$(MOD_C.libhob3lbase-test.a:.c=.o))
 MOD_D.libhob3lbase-test.a := $(addprefix out/bin/,$(MOD_C.libhob3lbase-test.a:.c=.d))
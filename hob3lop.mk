@@ -48,6 +48,15 @@ LIB_L.hob3lop-test.x := $(addprefix -l, $(LIB.hob3lop-test.x))
 
 ######################################################################
 
+# Int Benchmark Executable:
+MOD_C.hob3lop-bench.x := \
+    hob3lop/hob3lop-bench.c
+
+MOD_O.hob3lop-bench.x := $(addprefix out/bin/,$(MOD_C.hob3lop-bench.x:.c=.o))
+MOD_D.hob3lop-bench.x := $(addprefix out/bin/,$(MOD_C.hob3lop-bench.x:.c=.d))
+
+######################################################################
+
 _ := $(shell mkdir -p out/bin/hob3lop)
 _ := $(shell mkdir -p out/test/hob3lop)
 _ := $(shell mkdir -p out/src/hob3lop)
@@ -56,7 +65,8 @@ _ := $(shell mkdir -p out/src/hob3lop)
 
 all: \
     out/bin/$(LIB_)hob3lop$(_LIB) \
-    out/bin/hob3lop-test.x
+    out/bin/hob3lop-test.x \
+    out/bin/hob3lop-bench.x
 
 lib: $(LIB_A.hob3lop-test.x)
 
@@ -83,6 +93,13 @@ out/bin/hob3lop-test.x: \
 	    -Lout/bin $(LIB_L.hob3lop-test.x) \
 	    $(LIBS) -lm $(CFLAGS)
 
+out/bin/hob3lop-bench.x: \
+    $(MOD_O.hob3lop-bench.x) \
+    $(LIB_A.hob3lop-test.x)
+	$(CC) -o $@ $(MOD_O.hob3lop-bench.x) \
+	    -Lout/bin $(LIB_L.hob3lop-test.x) \
+	    $(LIBS) -lm $(CFLAGS)
+
 out/bin/hob3lop/hob3lop-test.o: CPPFLAGS += -Iout/src/hob3lop
 
 unit-test: unit-test-hobl3op
@@ -97,6 +114,12 @@ test-op: unit-test-hobl3op
 unit-test-hobl3op: out/bin/hob3lop-test.x
 	./out/bin/hob3lop-test.x
 
+bench: bench-hob3lop
+
+.PHONY: bench-hob3lop
+bench-hob3lop: out/bin/hob3lop-bench.x
+	./out/bin/hob3lop-bench.x --runs=$(BENCH_RUNS)
+
 ######################################################################
 # installation, the usual ceremony.
 
@@ -18,4 +18,23 @@ extern void cp_csg2_tree_put_js(
     cp_stream_t *s,
     cp_csg2_tree_t *t);
 
+/**
+ * Print as JavaScript file containing a WebGL scene configuration
+ * with the vertex, normal, colour, and index arrays in a separate
+ * binary file.
+ *
+ * The binary file contains little endian typed arrays (see
+ * doc/jsformat.md) that the viewer can load into ArrayBuffers
+ * without parsing.  The JavaScript file refers to the binary
+ * file by 'bin_name', which should be relative to the JS file.
+ *
+ * If 'bin' is NULL, this is equivalent to cp_csg2_tree_put_js(),
+ * which prints the compact encoding if t->opt->js_compact is set.
+ */
+extern void cp_csg2_tree_put_js_bin(
+    cp_stream_t *s,
+    cp_stream_t *bin,
+    char const *bin_name,
+    cp_csg2_tree_t *t);
+
 #endif /* CP_CSG2_2JS_H_ */
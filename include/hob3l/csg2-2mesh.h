@@ -0,0 +1,42 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_CSG2_2MESH_H_
+#define CP_CSG2_2MESH_H_
+
+#include <hob3lbase/stream_tam.h>
+#include <hob3l/csg2_tam.h>
+
+/**
+ * Print as binary little endian PLY file.
+ *
+ * Like STL, this generates one 3D solid for each layer, but stores
+ * each vertex only once and the faces as index triples.
+ */
+extern void cp_csg2_tree_put_ply(
+    cp_stream_t *s,
+    cp_csg2_tree_t *t);
+
+/**
+ * Print as Wavefront OBJ file.
+ *
+ * Like STL, this generates one 3D solid for each layer, but stores
+ * each vertex only once and the faces as index triples.
+ */
+extern void cp_csg2_tree_put_obj(
+    cp_stream_t *s,
+    cp_csg2_tree_t *t);
+
+/**
+ * Print as 3MF file.
+ *
+ * This writes a ZIP container with uncompressed entries with a single
+ * mesh object containing all layers.  Like STL, this generates one
+ * 3D solid for each layer, but stores each vertex only once and the
+ * faces as index triples.
+ */
+extern void cp_csg2_tree_put_3mf(
+    cp_stream_t *s,
+    cp_csg2_tree_t *t);
+
+#endif /* CP_CSG2_2MESH_H_ */
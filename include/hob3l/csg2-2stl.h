@@ -18,6 +18,8 @@
  *
  * This prints in 1:10 scale, i.e., if the input in MM,
  * the STL output is in CM.
+ *
+ * If t->opt->threads is not 1, the layers are formatted in parallel.
  */
 extern void cp_csg2_tree_put_stl(
     cp_stream_t *s,
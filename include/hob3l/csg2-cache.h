@@ -0,0 +1,63 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_CSG2_CACHE_H_
+#define CP_CSG2_CACHE_H_
+
+#include <stdint.h>
+#include <hob3lbase/err_tam.h>
+#include <hob3l/csg2_tam.h>
+
+/**
+ * Open the layer cache in directory 'dir' for the given key, which
+ * must be computed with cp_csg3_cache_layer_key().
+ *
+ * If a valid cache file exists, its layers can be retrieved with
+ * cp_csg2_cache_get().  Newly computed layers are added with
+ * cp_csg2_cache_put() and written by cp_csg2_cache_close().
+ */
+extern cp_csg2_cache_t *cp_csg2_cache_open(
+    char const *dir,
+    uint64_t key);
+
+/**
+ * Try to fill layer 'zi' of 'r' from the cache.
+ *
+ * 'r' must have been initialised by cp_csg2_op_tree_init() from 'a',
+ * and this does the same as cp_csg2_op_flatten_layer() if the layer
+ * is found.  The polygon gets the location of the root of 'a', like
+ * in cp_csg2_op_flatten_layer().
+ *
+ * Returns whether the layer was found.
+ */
+extern bool cp_csg2_cache_get(
+    cp_csg2_cache_t *c,
+    cp_csg2_tree_t *r,
+    cp_csg2_tree_t const *a,
+    size_t zi);
+
+/**
+ * Add layer 'zi' of 'r', computed by cp_csg2_op_flatten_layer(), to
+ * the cache.  The layer is written by cp_csg2_cache_close().
+ */
+extern void cp_csg2_cache_put(
+    cp_csg2_cache_t *c,
+    cp_csg2_tree_t const *r,
+    size_t zi);
+
+/**
+ * Write the cache file if new layers were added, and free the cache.
+ *
+ * The file contains all layers of the old file and all new layers.
+ * The directory is created if it does not exist.  The file is written
+ * under a temporary name and then renamed, so that concurrent runs
+ * never see a partial file.
+ *
+ * On error, a message is stored in err->msg and false is returned.
+ * The cache is freed in any case.
+ */
+extern bool cp_csg2_cache_close(
+    cp_err_t *err,
+    cp_csg2_cache_t *c);
+
+#endif /* CP_CSG2_CACHE_H_ */
@@ -16,6 +16,7 @@
 #include <hob3l/csg2-2ps.h>
 #include <hob3l/csg2-2scad.h>
 #include <hob3l/csg2-2stl.h>
+#include <hob3l/csg2-2mesh.h>
 #include <hob3l/csg2-2js.h>
 
 /** Create a CSG2 instance */
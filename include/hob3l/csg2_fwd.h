@@ -10,4 +10,6 @@ typedef struct cp_csg2_poly   cp_csg2_poly_t;
 typedef struct cp_csg2_vline2 cp_csg2_vline2_t;
 typedef struct cp_csg2_stack  cp_csg2_stack_t;
 
+typedef struct cp_csg2_cache cp_csg2_cache_t;
+
 #endif /* CP_CSG2_FWD_H_ */
@@ -0,0 +1,92 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_CSG3_CACHE_H_
+#define CP_CSG3_CACHE_H_
+
+#include <stdint.h>
+#include <hob3l/csg3_tam.h>
+#include <hob3l/scad_tam.h>
+#include <hob3l/syn_tam.h>
+
+/**
+ * Compute the cache key for a CSG3 tree computed from the main
+ * input file 'file' with the given options.
+ *
+ * The key depends on the name and content of the main file (which
+ * may be inline content without a file on disk), on all options that
+ * influence the CSG3 tree, and on the program itself.  The name is
+ * included because relative include and import paths are resolved
+ * against it.  Included and imported files are checked when loading
+ * a cache entry.
+ */
+extern uint64_t cp_csg3_cache_key(
+    cp_syn_file_t const *file,
+    cp_scad_opt_t const *scad,
+    cp_csg_opt_t const *csg);
+
+/**
+ * Compare two CSG3 trees and collect the bounding boxes of all
+ * subtrees that differ into 'changed'.
+ *
+ * Subtrees are compared by a hash of their geometry, so source
+ * locations are ignored.  A slice of the two trees at a z coordinate
+ * that is outside of all bounding boxes in 'changed' is the same.
+ *
+ * Returns false if the trees cannot be compared, e.g., because their
+ * root transformations differ.  'changed' is then undefined.
+ */
+extern bool cp_csg3_cache_diff(
+    cp_v_vec3_minmax_t *changed,
+    cp_csg3_tree_t const *a,
+    cp_csg3_tree_t const *b);
+
+/**
+ * Compute the cache key for the flattened layers of a CSG3 tree,
+ * see cp_csg2_cache_open().
+ *
+ * The key depends on the geometry of the tree (but not on source
+ * locations), on the options of the 2D bool operations, on the
+ * grid and epsilon values, and on the program itself.  It does not
+ * depend on the z range or step, because layers are looked up by
+ * their z coordinate.
+ */
+extern uint64_t cp_csg3_cache_layer_key(
+    cp_csg3_tree_t const *r,
+    cp_csg_opt_t const *csg);
+
+/**
+ * Try to load a CSG3 tree from the cache directory 'dir'.
+ *
+ * 'input' must contain only the main file, which was used to compute
+ * 'key' with cp_csg3_cache_key().  On success, all files the tree was
+ * computed from are read and appended to 'input', and 'r' is filled
+ * in (r->opt is not touched).  If there is no valid cache entry,
+ * or any file has changed, this returns false and leaves 'input' and
+ * 'r' unchanged.
+ */
+extern bool cp_csg3_cache_load(
+    cp_csg3_tree_t *r,
+    cp_syn_input_t *input,
+    char const *dir,
+    uint64_t key);
+
+/**
+ * Store a CSG3 tree in the cache directory 'dir'.
+ *
+ * 'input' must contain all files that the tree was computed from,
+ * with the main file at index 0, which was used to compute 'key' with
+ * cp_csg3_cache_key().  The directory is created if it does not
+ * exist.  The file is written under a temporary name and then renamed,
+ * so that concurrent runs never see a partial file.
+ *
+ * On error, a message is stored in err->msg and false is returned.
+ */
+extern bool cp_csg3_cache_store(
+    cp_err_t *err,
+    char const *dir,
+    uint64_t key,
+    cp_syn_input_t const *input,
+    cp_csg3_tree_t const *r);
+
+#endif /* CP_CSG3_CACHE_H_ */
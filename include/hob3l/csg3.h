@@ -41,6 +41,8 @@ typedef struct {
     cp_err_t *err;
     unsigned context;
     cp_scad_t *search_root;
+    cp_csg3_import_cache_t *import_cache;
+    cp_csg3_prim_cache_t *prim_cache;
 } cp_csg3_ctxt_t;
 
 /**
@@ -66,6 +68,19 @@ extern unsigned cp_csg3_get_fn(
     double max_length,
     double mag);
 
+/**
+ * Get bounding box of a single CSG3 object.
+ *
+ * If max is non-false, the bb will include structures that are
+ * subtracted.
+ *
+ * bb will not be cleared, but only updated.
+ */
+extern void cp_csg3_minmax(
+    cp_vec3_minmax_t *bb,
+    cp_obj_t const *r,
+    bool max);
+
 /**
  * Get bounding box of all points, including those that are
  * in subtracted parts that will be outside of the final solid.
@@ -93,6 +108,17 @@ extern bool cp_csg3_from_scad_tree(
     cp_err_t *t,
     cp_scad_tree_t const *scad);
 
+/**
+ * Create a cache of imported files that is shared among runs on any
+ * thread, e.g., by a server.  Use it by setting the import_cache of
+ * a CSG3 tree.
+ *
+ * Each version of a file, identified by name, modification time, and
+ * size, is read and parsed once and then kept, so the cache only
+ * grows.  It is never freed.
+ */
+extern cp_csg3_import_cache_t *cp_csg3_import_cache_new(void);
+
 /**
  * Returns a new unit matrix.
  */
@@ -105,4 +131,47 @@ static inline cp_mat3wi_t *cp_csg3_mat_new(
     return m;
 }
 
+/**
+ * Returns the polyhedron that stores the mesh of p, i.e., the base
+ * polyhedron if p is an instance, otherwise p itself.
+ */
+static inline cp_csg3_poly_t const *cp_csg3_poly_mesh(
+    cp_csg3_poly_t const *p)
+{
+    return (p->base != NULL) ? p->base : p;
+}
+
+/**
+ * Returns the j-th point of face f of the mesh of p (see
+ * cp_csg3_poly_mesh()) in the orientation of p.  This reverses the
+ * face if p is a mirrored instance.
+ */
+static inline cp_vec3_loc_ref_t const *cp_csg3_poly_face_nth(
+    cp_csg3_poly_t const *p,
+    cp_csg3_face_t const *f,
+    size_t j)
+{
+    assert(j < f->point.size);
+    if ((p->mat != NULL) && (p->mat->d < 0)) {
+        j = f->point.size - 1 - j;
+    }
+    return &f->point.data[j];
+}
+
+/**
+ * Stores in r the world coordinates of the point v of the mesh of p
+ * (see cp_csg3_poly_mesh()).
+ */
+static inline void cp_csg3_poly_coord(
+    cp_vec3_t *r,
+    cp_csg3_poly_t const *p,
+    cp_vec3_t const *v)
+{
+    if (p->mat == NULL) {
+        *r = *v;
+        return;
+    }
+    cp_vec3w_xform(r, &p->mat->n, v);
+}
+
 #endif /* CP_CSG3_H_ */
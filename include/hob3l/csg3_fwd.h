@@ -8,5 +8,6 @@ typedef struct cp_csg3 cp_csg3_t;
 
 typedef struct cp_csg3_face cp_csg3_face_t;
 typedef struct cp_csg3_edge cp_csg3_edge_t;
+typedef struct cp_csg3_poly cp_csg3_poly_t;
 
 #endif /* CP_CSG3_FWD_H_ */
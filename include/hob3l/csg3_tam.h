@@ -86,7 +86,7 @@ struct cp_csg3_face {
 
 typedef CP_VEC_T(cp_csg3_face_t) cp_v_csg3_face_t;
 
-typedef struct {
+struct cp_csg3_poly {
     /**
      * type is CP_CSG3_POLY */
     CP_CSG3_
@@ -103,7 +103,20 @@ typedef struct {
     /**
      * The faces of the polyhedron. */
     cp_v_csg3_face_t face;
-} cp_csg3_poly_t;
+
+    /**
+     * If non-NULL, this polyhedron is an instance of 'base' transformed
+     * by 'mat', and 'point' and 'face' are empty.  This is used to share
+     * one mesh among all imports of the same file, and among all
+     * cubes, cylinders, and polyhedral spheres with equal parameters.  Use cp_csg3_poly_mesh()
+     * and cp_csg3_poly_coord() to access the points of any polyhedron.
+     */
+    cp_csg3_poly_t const *base;
+
+    /**
+     * The transformation of an instance, NULL if 'base' is NULL. */
+    cp_mat3wi_t const *mat;
+};
 
 typedef cp_csg2_poly_t cp_csg3_poly2_t;
 
@@ -114,11 +127,28 @@ typedef cp_csg2_poly_t cp_csg3_poly2_t;
  */
 struct cp_csg3 { CP_CSG3_; };
 
+/**
+ * Cache of imported files (opaque, see csg3.c).
+ */
+typedef struct cp_csg3_import_cache cp_csg3_import_cache_t;
+
+/**
+ * Meshes of primitives shared among their instances (opaque, see
+ * csg3.c).
+ */
+typedef struct cp_csg3_prim_cache cp_csg3_prim_cache_t;
+
 typedef struct {
     cp_v_mat3wi_p_t mat;
     cp_csg_add_t *root;
     cp_csg_opt_t const *opt;
     cp_mat3wi_t const *root_xform;
+
+    /**
+     * If non-NULL, imported files are taken from this cache, which is
+     * shared among runs, see cp_csg3_import_cache_new().  Otherwise,
+     * each file is read once per run. */
+    cp_csg3_import_cache_t *import_cache;
 } cp_csg3_tree_t;
 
 #endif /* CP_CSG3_TAM_H_ */
@@ -120,6 +120,7 @@ struct cp_csg { CP_CSG_ };
         .max_fn = 100, \
         .optimise = CP_CSG2_OPT_DEFAULT, \
         .color_rand = 0, \
+        .threads = 1, \
     }
 
 /**
@@ -154,6 +155,14 @@ typedef struct {
      * With which groups to tag the output file, space or comma separated */
     cp_vchar_t js_group;
 
+    /**
+     * Whether to print JS/WebGL output in compact encoding */
+    bool js_compact;
+
+    /**
+     * Number of threads for output formatting, 0 = one per processor */
+    unsigned threads;
+
     /**
      * Optimisation.  See CP_CSG2_OPT* constants. */
     unsigned optimise;
@@ -0,0 +1,127 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_STATS_H_
+#define CP_STATS_H_
+
+#include <hob3lbase/stream_tam.h>
+#include <hob3lbase/pool_tam.h>
+#include <hob3l/stats_tam.h>
+#include <hob3l/csg2_tam.h>
+#include <hob3l/csg3_tam.h>
+#include <hob3l/syn_tam.h>
+
+/**
+ * Where statistics are collected, or NULL if they are not.
+ *
+ * Each thread has its own value, which starts as NULL.
+ */
+extern _Thread_local cp_stats_t *cp_stats;
+
+/**
+ * Start measuring the time of a stage.
+ *
+ * Does nothing unless statistics are collected.
+ */
+extern void cp_stats_begin(
+    cp_stats_time_t *t);
+
+/**
+ * Stop measuring the time started with cp_stats_begin() and add it
+ * to the given stage.  Also sample the peak RSS of the process, so
+ * that the stage that makes it grow can be seen.
+ *
+ * Does nothing unless statistics are collected.
+ */
+extern void cp_stats_end(
+    cp_stats_stage_t stage,
+    cp_stats_time_t const *t);
+
+/**
+ * Start measuring the time attributed to a source location.
+ *
+ * Does nothing unless --profile-objects is active.
+ */
+extern void cp_stats_obj_begin(
+    double *t);
+
+/**
+ * Attribute the time since cp_stats_obj_begin() and the given number
+ * of line segments to the slicing of a CSG leaf.
+ */
+extern void cp_stats_obj_slice(
+    cp_loc_t loc,
+    double const *t,
+    size_t seg_cnt);
+
+/**
+ * Attribute the time since cp_stats_obj_begin() and the counters of
+ * a plane sweep to the bool operation at a source location.
+ */
+extern void cp_stats_obj_bool(
+    cp_loc_t loc,
+    double const *t,
+    cq_sweep_t const *sweep);
+
+/**
+ * Free the cost per source location.
+ */
+extern void cp_stats_fini(
+    cp_stats_t *st);
+
+/**
+ * Count the polyhedra and faces of a CSG3 tree.
+ */
+extern void cp_stats_csg3(
+    cp_csg3_tree_t const *r);
+
+/**
+ * Count line segments from slicing the current layer.
+ */
+extern void cp_stats_seg(
+    size_t n);
+
+/**
+ * Finish layer 'zi': count it, and take the maximum of its segment
+ * count and of the memory used in its temporary pool.
+ */
+extern void cp_stats_layer(
+    cp_pool_t const *pool,
+    size_t zi);
+
+/**
+ * Add the statistics of a plane sweep after cq_sweep_reduce().
+ */
+extern void cp_stats_sweep(
+    cq_sweep_t const *sweep);
+
+/**
+ * Count the triangles of all layers of a flattened CSG2 tree, i.e.,
+ * one that was initialised with cp_csg2_op_tree_init().
+ */
+extern void cp_stats_csg2(
+    cp_csg2_tree_t const *r);
+
+/**
+ * Print statistics of processing file 'fn', either as text lines
+ * starting with 'Stats:' or as a single line JSON object.
+ */
+extern void cp_stats_put(
+    cp_stream_t *s,
+    char const *fn,
+    cp_stats_t const *st,
+    bool json);
+
+/**
+ * Print the 'top' most expensive source locations, sorted by the
+ * sum of slice and bool time, as text lines starting with 'Profile:'.
+ *
+ * 'input' is used to find file name and line of each location.
+ */
+extern void cp_stats_put_obj(
+    cp_stream_t *s,
+    cp_syn_input_t *input,
+    cp_stats_t const *st,
+    size_t top);
+
+#endif /* CP_STATS_H_ */
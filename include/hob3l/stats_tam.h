@@ -0,0 +1,137 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_STATS_TAM_H_
+#define CP_STATS_TAM_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <hob3lbase/err_tam.h>
+#include <hob3lbase/alloc_tam.h>
+#include <hob3lbase/dict_tam.h>
+#include <hob3lop/op-sweep.h>
+
+/**
+ * Processing stages for which time is measured.
+ */
+typedef enum {
+    CP_STATS_READ,
+    CP_STATS_PARSE,
+    CP_STATS_SCAD,
+    CP_STATS_CSG3,
+    CP_STATS_SLICE,
+    CP_STATS_BOOL,
+    CP_STATS_TRI,
+    CP_STATS_OUTPUT,
+    CP_STATS_STAGE_CNT
+} cp_stats_stage_t;
+
+/**
+ * A point in time, or a duration, in seconds.
+ */
+typedef struct {
+    /**
+     * Monotonic wall clock time */
+    double wall;
+
+    /**
+     * CPU time of the thread processing the file, including the
+     * worker threads it started, e.g., for parallel STL output */
+    double cpu;
+} cp_stats_time_t;
+
+/**
+ * Cost of one source location for --profile-objects.
+ */
+typedef struct {
+    /**
+     * Node in cp_stats_t.obj, sorted by loc */
+    cp_dict_t node_loc;
+
+    /**
+     * The source location of a CSG leaf or operator */
+    cp_loc_t loc;
+
+    /**
+     * Wall clock time spent slicing the leaf and in sweeps of the
+     * bool operation, in seconds */
+    double slice;
+    double bool_;
+
+    /**
+     * Number of line segments from slicing the leaf */
+    size_t seg_cnt;
+
+    /**
+     * Statistics of the sweeps of the bool operation */
+    cq_sweep_stat_t sweep;
+} cp_stats_obj_t;
+
+/**
+ * Statistics of processing one input file.
+ */
+typedef struct {
+    /**
+     * Time spent in each stage */
+    cp_stats_time_t time[CP_STATS_STAGE_CNT];
+
+    /**
+     * CPU time of worker threads that were joined, see cp_par_cpu */
+    double par_cpu;
+
+    /**
+     * Peak resident set size of the process in bytes, sampled at the
+     * end of each stage */
+    size_t rss[CP_STATS_STAGE_CNT];
+
+    /**
+     * Number of polyhedra and their faces in the CSG3 tree */
+    size_t poly_cnt;
+    size_t face_cnt;
+
+    /**
+     * Number of layers sliced, i.e., not reused or read from a cache */
+    size_t layer_cnt;
+
+    /**
+     * Number of line segments from slicing: in total, in the current
+     * layer, and in the layer with the most segments */
+    size_t seg_cnt;
+    size_t seg_layer;
+    size_t seg_max;
+
+    /**
+     * Statistics of all plane sweeps of the bool operations */
+    cq_sweep_stat_t sweep;
+
+    /**
+     * Number of triangles in the output */
+    size_t tri_cnt;
+
+    /**
+     * Maximum number of bytes used in the temporary pool of a layer,
+     * and the index of that layer */
+    size_t pool_max;
+    size_t pool_layer;
+
+    /**
+     * Maximum number of blocks and bytes held by the temporary pool,
+     * including free blocks */
+    size_t pool_block_cnt;
+    size_t pool_block_max;
+
+    /**
+     * Counters of the global allocator for this file, including the
+     * allocations of worker threads */
+    cp_alloc_stat_t alloc;
+
+    /**
+     * Whether to collect the cost per source location in 'obj' */
+    bool obj_profile;
+
+    /**
+     * Cost per source location, of type cp_stats_obj_t */
+    cp_dict_t *obj;
+} cp_stats_t;
+
+#endif /* CP_STATS_TAM_H_ */
@@ -25,6 +25,20 @@
 /** Cast w/ dynamic check */
 #define cp_syn_try_cast(t, s) cp_try_cast_(cp_syn_typeof, t, s)
 
+/**
+ * Get the name of a file as it is opened by cp_syn_read().
+ *
+ * If include_loc is not NULL and filename is relative, this is
+ * relative to the directory of the file that contains include_loc.
+ * The result is appended to 'out', which is NUL terminated.
+ */
+extern bool cp_syn_resolve(
+    cp_vchar_t *out,
+    cp_err_t *err,
+    cp_syn_input_t *input,
+    cp_loc_t include_loc,
+    char const *filename);
+
 /**
  * Read a file into memory and store it in the input file table.
  *
@@ -42,6 +56,42 @@ extern bool cp_syn_read(
     char const *filename,
     FILE *file);
 
+/**
+ * Read a file for a cache that is kept longer than 'input', and
+ * store it in the input file table.
+ *
+ * The file and its content are allocated outside of any arena.  The
+ * file is read instead of mapped, because a mapped file that is
+ * truncated later raises SIGBUS, and it is closed after reading.  It
+ * is marked 'shared' so that cp_syn_input_fini() leaves it alone.
+ *
+ * Returns NULL on error.
+ */
+extern cp_syn_file_t *cp_syn_read_shared(
+    cp_err_t *err,
+    cp_syn_input_t *input,
+    cp_loc_t include_loc,
+    char const *filename);
+
+/**
+ * Create a cache of included files that is shared among runs on any
+ * thread, e.g., by a server.
+ *
+ * Each version of a file is read and parsed once and then kept, so
+ * the cache only grows.  It is never freed.
+ */
+extern cp_syn_cache_t *cp_syn_cache_new(void);
+
+/**
+ * Close all files of the input and release their memory mappings.
+ *
+ * This also closes a file passed to cp_syn_read().  Source locations
+ * into the files are invalid afterwards.  The memory of the input
+ * itself is not freed.  Files of a cp_syn_cache_t are left alone.
+ */
+extern void cp_syn_input_fini(
+    cp_syn_input_t *input);
+
 /**
  * Parse a file into a SCAD syntax tree.
  */
@@ -220,6 +220,10 @@ typedef struct {
      * character longer than the file.  This is also the reason why
      * this string cannot reasonably be used to display the erroneous
      * line in an error message.  To do that, use content_orig.
+     *
+     * If 'mapped' is set, this points into a private memory mapping
+     * of the file instead of a heap allocation, so it must not be
+     * resized or freed.
      */
     cp_vchar_t content;
 
@@ -229,6 +233,19 @@ typedef struct {
      */
     cp_vchar_t content_orig;
 
+    /**
+     * Whether content and content_orig are memory mappings of the
+     * file rather than copies read into heap memory.
+     */
+    bool mapped;
+
+    /**
+     * Whether this file belongs to a cp_syn_cache_t.  It lives as long
+     * as the cache and is shared among inputs, so cp_syn_input_fini()
+     * leaves it alone.
+     */
+    bool shared;
+
     /**
      * List of lines.  Each C pointer points into content.  The last
      * entry in this array points to the terminating '\0' that the
@@ -266,6 +283,11 @@ typedef struct {
 
 typedef CP_VEC_T(cp_syn_file_t *) cp_v_syn_file_p_t;
 
+/**
+ * Cache of included files that is shared among runs (opaque, see syn.c).
+ */
+typedef struct cp_syn_cache cp_syn_cache_t;
+
 /**
  * All loaded input files.
  */
@@ -275,6 +297,30 @@ typedef struct {
      * The entry at index 0 is the top-level file.
      */
     cp_v_syn_file_p_t file;
+
+    /**
+     * Number of warnings that were printed for locations in these
+     * files.
+     */
+    size_t warn_cnt;
+
+    /**
+     * Where warnings are printed, or NULL for stderr.
+     */
+    FILE *msg_file;
+
+    /**
+     * Whether to read files instead of mapping them into memory.  A
+     * mapped file that is truncated while it is parsed raises SIGBUS,
+     * which a long running server must not risk.
+     */
+    bool no_map;
+
+    /**
+     * If non-NULL, included files are read and parsed only once and
+     * taken from this cache, see cp_syn_cache_new().
+     */
+    cp_syn_cache_t *cache;
 } cp_syn_input_t;
 
 /**
@@ -0,0 +1,58 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_TIMELINE_H_
+#define CP_TIMELINE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * Open the timeline file 'fn' and start recording.
+ *
+ * This must be called before any thread starts processing.  Returns
+ * false if the file cannot be opened, with errno set.
+ */
+extern bool cp_timeline_open(
+    char const *fn);
+
+/**
+ * Finish and close the timeline file.
+ *
+ * This must be called after all threads have stopped processing.
+ * Does nothing if no timeline is open.
+ */
+extern void cp_timeline_close(void);
+
+/**
+ * Write all recorded spans to the file so that the timeline can be
+ * viewed while the process is still running.  The file lacks the
+ * closing brackets until cp_timeline_close(), which the viewers
+ * accept.
+ */
+extern void cp_timeline_flush(void);
+
+/**
+ * Start a span.
+ *
+ * Does nothing unless a timeline is open.
+ */
+extern void cp_timeline_begin(
+    double *t);
+
+/**
+ * End a span started with cp_timeline_begin() and write it to the
+ * timeline, tagged with the calling thread.
+ *
+ * 'cat' is the category, 'name' is the name of the span, and 'zi' is
+ * the layer index, or CP_SIZE_MAX if the span is not about a layer.
+ *
+ * Does nothing unless a timeline is open.
+ */
+extern void cp_timeline_end(
+    double const *t,
+    char const *cat,
+    char const *name,
+    size_t zi);
+
+#endif /* CP_TIMELINE_H_ */
@@ -5,18 +5,30 @@
 #define CP_VEC3_DICT_H_
 
 #include <hob3lmat/mat_gen_tam.h>
-#include <hob3lbase/pool_tam.h>
 #include <hob3l/vec3-dict_tam.h>
 
+/**
+ * Prepare the dictionary for storing about 'size' points without
+ * rehashing.
+ */
+extern void cp_vec3_dict_reserve(
+    cp_vec3_dict_t *dict,
+    size_t size);
+
 /**
  * Insert or find a vec3 in the given dictionary.
  *
  * Returns the insertion position, starting at 0.
  */
-extern cp_vec3_dict_node_t *cp_vec3_dict_insert(
-    cp_pool_t *pool,
+extern size_t cp_vec3_dict_insert(
     cp_vec3_dict_t *dict,
     cp_vec3_t const *v,
     cp_loc_t loc);
 
+/**
+ * Free the hash table and the point vector.
+ */
+extern void cp_vec3_dict_fini(
+    cp_vec3_dict_t *dict);
+
 #endif /* CP_VEC3_DICT_H_ */
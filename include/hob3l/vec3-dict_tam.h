@@ -4,19 +4,31 @@
 #ifndef CP_VEC3_DICT_TAM_H_
 #define CP_VEC3_DICT_TAM_H_
 
-#include <hob3lbase/dict_tam.h>
+#include <hob3lbase/base-mat_tam.h>
 
+/**
+ * Hash table slot: index of the point + 1 (0 = empty slot), and the
+ * hash of the grid cell the point was inserted into.
+ */
 typedef struct {
-    cp_dict_t *root;
-    size_t size;
-} cp_vec3_dict_t;
+    size_t idx1;
+    size_t hash;
+} cp_vec3_dict_slot_t;
 
+/**
+ * Set of points, unified by cp_eq() of each coordinate.
+ *
+ * Points are stored in insertion order in 'point', so the index of
+ * each point is its insertion position.  The lookup is an open
+ * addressing hash table over a grid of cells somewhat larger than
+ * cp_eq_epsilon, so that each point has to be compared only with the
+ * few points in the neighbouring cells.
+ */
 typedef struct {
-    cp_dict_t node;
-    cp_vec3_t coord;
-    cp_loc_t loc;
-    size_t idx;
-} cp_vec3_dict_node_t;
-
+    cp_v_vec3_loc_t point;
+    cp_vec3_dict_slot_t *slot;
+    size_t slot_mask;
+    double cell;
+} cp_vec3_dict_t;
 
 #endif /* CP_VEC3_DICT_TAM_H_ */
@@ -117,6 +117,23 @@
 
 extern cp_alloc_t cp_alloc_global;
 
+/**
+ * Where the global allocator counts allocations of this thread, or
+ * NULL if it does not count them.
+ *
+ * Each thread has its own value, which starts as NULL, so counting
+ * costs nothing but a test of a thread local variable unless it is
+ * enabled, and enabled counters are not shared between threads.
+ */
+extern _Thread_local cp_alloc_stat_t *cp_alloc_stat;
+
+/**
+ * Add the counters 'a' to 'r'.
+ */
+extern void cp_alloc_stat_add(
+    cp_alloc_stat_t *r,
+    cp_alloc_stat_t const *a);
+
 static inline void *cp_malloc_(
     char const *file, int line, cp_alloc_t *m, size_t a, size_t b)
 {
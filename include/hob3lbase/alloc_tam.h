@@ -16,4 +16,20 @@ struct cp_alloc {
     void  (*x_free)     (cp_alloc_t *alloc, void *p);
 };
 
+/**
+ * Counters of the global allocator, see cp_alloc_stat.
+ */
+typedef struct {
+    /**
+     * Number of objects allocated and freed */
+    size_t alloc_cnt;
+    size_t free_cnt;
+
+    /**
+     * Bytes requested in total, including the growth by reallocation.
+     * This is not the number of live bytes: free() does not know the
+     * size of the object. */
+    size_t alloc_size;
+} cp_alloc_stat_t;
+
 #endif /* CP_ALLOC_TAM_H_ */
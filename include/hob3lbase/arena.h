@@ -0,0 +1,96 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+/**
+ * @file
+ * Arenas for the global allocator.
+ *
+ * While an arena is entered on a thread, all allocations of that
+ * thread with the global allocator (CP_NEW, cp_v_push, ...) are taken
+ * from the arena.  Destructing the arena frees all of them at once.
+ * Small objects are allocated from a pool, which is much faster than
+ * malloc().
+ *
+ * Memory of an arena may be freed or reallocated with the global
+ * allocator on any thread and at any time before the arena is
+ * destructed.  Freeing is a no-op for small objects, reallocating
+ * copies them.
+ */
+
+#ifndef CP_ARENA_H_
+#define CP_ARENA_H_
+
+#include <stdbool.h>
+#include <hob3lbase/arena_tam.h>
+
+/**
+ * Initialise an arena.
+ */
+extern void cp_arena_init(
+    cp_arena_t *a);
+
+/**
+ * Free all memory of an arena.
+ *
+ * The arena must not be entered on any thread.  It can be used again
+ * after cp_arena_init().
+ */
+extern void cp_arena_fini(
+    cp_arena_t *a);
+
+/**
+ * Enter an arena on the calling thread, or leave all arenas if 'a' is
+ * NULL.  Returns the previously entered arena so that it can be
+ * restored with cp_arena_leave().
+ */
+extern cp_arena_t *cp_arena_enter(
+    cp_arena_t *a);
+
+/**
+ * Leave the current arena on the calling thread and restore the one
+ * returned by cp_arena_enter().
+ */
+extern void cp_arena_leave(
+    cp_arena_t *prev);
+
+/**
+ * Return the arena entered on the calling thread, or NULL.
+ */
+extern cp_arena_t *cp_arena_current(void);
+
+/**
+ * Allocate zeroed memory from an arena.
+ *
+ * This is used by the global allocator.  Returns NULL if out of memory.
+ */
+extern void *cp_arena_calloc(
+    cp_arena_t *a,
+    size_t n,
+    size_t size);
+
+/**
+ * Free memory if it belongs to an arena.
+ *
+ * This is used by the global allocator.  Returns whether p belongs to
+ * an arena.  Otherwise, nothing is done.
+ */
+extern bool cp_arena_free(
+    void *p);
+
+/**
+ * Reallocate memory if it belongs to an arena or if an arena is
+ * entered and p is NULL.
+ *
+ * This is used by the global allocator, and an >= ao must hold.  The
+ * new part of the memory is not necessarily zeroed.  Returns whether
+ * the reallocation was done, with the result in *q, which is NULL if
+ * out of memory.  Otherwise, nothing is done.
+ */
+extern bool cp_arena_realloc(
+    void **q,
+    void *p,
+    size_t ao,
+    size_t an,
+    size_t b);
+
+#endif /* CP_ARENA_H_ */
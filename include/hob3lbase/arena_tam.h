@@ -0,0 +1,33 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_ARENA_TAM_H_
+#define CP_ARENA_TAM_H_
+
+#include <hob3lbase/alloc_tam.h>
+#include <hob3lbase/pool_tam.h>
+#include <hob3lbase/list_tam.h>
+
+/**
+ * An arena that collects all allocations of the global allocator on
+ * a thread while it is entered, so that they can be freed together.
+ *
+ * Small objects are allocated from 'pool', large ones are allocated
+ * individually.
+ */
+typedef struct {
+    /**
+     * Pool for small objects.  Its blocks are allocated with
+     * 'block_alloc'. */
+    cp_pool_t pool;
+
+    /**
+     * Allocator for the blocks of 'pool'. */
+    cp_alloc_t block_alloc[1];
+
+    /**
+     * Ring of the large objects, linked via their headers. */
+    cp_list_t large;
+} cp_arena_t;
+
+#endif /* CP_ARENA_TAM_H_ */
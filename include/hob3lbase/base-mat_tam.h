@@ -12,6 +12,7 @@ typedef CP_VEC_T(cp_vec2_t) cp_v_vec2_t;
 typedef CP_VEC_T(cp_vec2_t*) cp_v_vec2_p_t;
 typedef CP_VEC_T(cp_vec3_t) cp_v_vec3_t;
 typedef CP_VEC_T(cp_vec3_t*) cp_v_vec3_p_t;
+typedef CP_VEC_T(cp_vec3_minmax_t) cp_v_vec3_minmax_t;
 typedef CP_VEC_T(cp_vec4_t) cp_v_vec4_t;
 typedef CP_VEC_T(cp_vec4_t*) cp_v_vec4_p_t;
 typedef CP_VEC_T(cp_mat2_t) cp_v_mat2_t;
@@ -0,0 +1,69 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_FMT_H_
+#define CP_FMT_H_
+
+#include <hob3lbase/fmt_tam.h>
+
+/**
+ * Format a double for use with "%s" in a printf format string.
+ * The buffer lives until the end of the enclosing block.
+ */
+#define CP_FMT_D(x) cp_fmt_double_str(&(cp_fmt_buf_t){ .c = {0} }, (x))
+
+/**
+ * Format a float for use with "%s" in a printf format string.
+ * The buffer lives until the end of the enclosing block.
+ */
+#define CP_FMT_F(x) cp_fmt_float_str(&(cp_fmt_buf_t){ .c = {0} }, (x))
+
+/**
+ * Print a double in the shortest form that reads back as the same
+ * double, in the style of %g, but independent of the locale.
+ *
+ * The output is NUL terminated.  'buf' must have space for at least
+ * CP_FMT_MAX characters.  Returns a pointer to the terminating NUL.
+ */
+extern char *cp_fmt_double(
+    char *buf,
+    double x);
+
+/**
+ * Print a float in the shortest form that reads back as the same
+ * float, in the style of %g, but independent of the locale.
+ *
+ * The output is NUL terminated.  'buf' must have space for at least
+ * CP_FMT_MAX characters.  Returns a pointer to the terminating NUL.
+ */
+extern char *cp_fmt_float(
+    char *buf,
+    float x);
+
+/**
+ * Print a signed integer in decimal.
+ *
+ * The output is NUL terminated.  'buf' must have space for at least
+ * CP_FMT_MAX characters.  Returns a pointer to the terminating NUL.
+ */
+extern char *cp_fmt_long(
+    char *buf,
+    long x);
+
+/**
+ * Same as cp_fmt_double, but returns the beginning of the buffer.
+ * See CP_FMT_D().
+ */
+extern char const *cp_fmt_double_str(
+    cp_fmt_buf_t *b,
+    double x);
+
+/**
+ * Same as cp_fmt_float, but returns the beginning of the buffer.
+ * See CP_FMT_F().
+ */
+extern char const *cp_fmt_float_str(
+    cp_fmt_buf_t *b,
+    float x);
+
+#endif /* CP_FMT_H_ */
@@ -0,0 +1,20 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_FMT_TAM_H_
+#define CP_FMT_TAM_H_
+
+/**
+ * Maximum length of a formatted number, including the NUL
+ * terminator.
+ */
+#define CP_FMT_MAX 32
+
+/**
+ * Buffer for a single formatted number.
+ */
+typedef struct {
+    char c[CP_FMT_MAX];
+} cp_fmt_buf_t;
+
+#endif /* CP_FMT_TAM_H_ */
@@ -0,0 +1,21 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_HASH_H_
+#define CP_HASH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Compute a 64-bit hash of 'size' bytes at 'data'.
+ *
+ * Several blocks can be hashed together by passing the result of one
+ * call as 'seed' to the next.
+ */
+extern uint64_t cp_hash64(
+    void const *data,
+    size_t size,
+    uint64_t seed);
+
+#endif /* CP_HASH_H_ */
@@ -0,0 +1,49 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_PAR_H_
+#define CP_PAR_H_
+
+#include <hob3lbase/par_tam.h>
+
+/**
+ * Where cp_par_ordered() adds the CPU time of its worker threads,
+ * or NULL if it does not.  The time of the calling thread itself is
+ * not included.
+ *
+ * Each thread has its own value, which starts as NULL.
+ */
+extern _Thread_local double *cp_par_cpu;
+
+/**
+ * Return the number of threads to use for a requested number:
+ * 0 means the number of online processors.
+ */
+extern unsigned cp_par_thread_cnt(
+    unsigned threads);
+
+/**
+ * Process n items on 'threads' worker threads (0 = one per processor)
+ * with ordered output.
+ *
+ * work() produces the output of each item into a buffer, and emit()
+ * is called on the calling thread with the buffers in order of the
+ * items.  At most 'window' items are processed ahead of emission
+ * (0 = 4 per thread), which bounds the memory use.
+ *
+ * With a single thread, this calls work() and emit() alternately
+ * without starting any threads.
+ *
+ * If the calling thread counts allocations in cp_alloc_stat, the
+ * allocations of the workers are added to it when they are done.
+ * Likewise, their CPU time is added to cp_par_cpu.
+ */
+extern void cp_par_ordered(
+    size_t n,
+    unsigned threads,
+    size_t window,
+    cp_par_work_t work,
+    cp_par_emit_t emit,
+    void *user);
+
+#endif /* CP_PAR_H_ */
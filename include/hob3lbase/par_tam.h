@@ -0,0 +1,28 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_PAR_TAM_H_
+#define CP_PAR_TAM_H_
+
+#include <stddef.h>
+#include <hob3lbase/vchar_tam.h>
+
+/**
+ * Work function for cp_par_ordered: produce the output of item i
+ * into 'out'.  This runs on a worker thread.
+ */
+typedef void (*cp_par_work_t)(
+    void *user,
+    size_t i,
+    cp_vchar_t *out);
+
+/**
+ * Emit function for cp_par_ordered: consume the output of item i.
+ * This runs on the calling thread, in order of i.
+ */
+typedef void (*cp_par_emit_t)(
+    void *user,
+    size_t i,
+    cp_vchar_t *out);
+
+#endif /* CP_PAR_TAM_H_ */
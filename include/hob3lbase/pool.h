@@ -43,6 +43,13 @@
 extern void cp_pool_clear(
     cp_pool_t *a);
 
+/**
+ * Return the number of bytes allocated from the pool since it was
+ * last cleared, including alignment padding.
+ */
+extern size_t cp_pool_size(
+    cp_pool_t const *a);
+
 /**
  * Throw away all blocks (and hence, all allocated objects) of the allocator.
  */
@@ -18,6 +18,23 @@ typedef struct {
     size_t block_size;
     cp_pool_block_list_t free;
     cp_pool_block_list_t used;
+
+    /**
+     * Allocator for the blocks, or NULL for the global allocator. */
+    cp_alloc_t *block_alloc;
+
+    /**
+     * Bytes allocated from the pool since it was last cleared, and the
+     * maximum of this since the pool was initialised */
+    size_t used_size;
+    size_t used_max;
+
+    /**
+     * Number of blocks and their total size in bytes, both used and
+     * free, and the maximum of the size since the pool was initialised */
+    size_t block_cnt;
+    size_t block_size_sum;
+    size_t block_size_max;
 } cp_pool_t;
 
 #endif /*CP_POOL_H_ */
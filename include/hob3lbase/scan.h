@@ -0,0 +1,18 @@
+/* -*- Mode: C -*- */
+/* Copyright (C) 2018-2024 by Henrik Theiling, License: GPLv3, see LICENSE file */
+
+#ifndef CP_SCAN_H_
+#define CP_SCAN_H_
+
+/**
+ * Convert a decimal number to double like strtod(), but faster for
+ * the usual case of at most 19 significant digits.
+ *
+ * The result is the same as that of strtod(), including the value
+ * of 'end', if it is not NULL.
+ */
+extern double cp_scan_double(
+    char const *s,
+    char const **end);
+
+#endif /* CP_SCAN_H_ */
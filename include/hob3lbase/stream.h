@@ -25,10 +25,18 @@
 #define CP_STREAM_FROM_VCHAR(vchar) \
     (&(cp_stream_t){ \
         .data = (vchar), \
-        .vprintf = (cp_stream_vprintf_t)cp_vchar_printf, \
+        .vprintf = (cp_stream_vprintf_t)cp_vchar_vprintf, \
         .write = (cp_stream_write_t)cp_vchar_append_arr, \
     })
 
+#define CP_STREAM_FROM_FD(fdstream) \
+    (&(cp_stream_t){ \
+        .data = (fdstream), \
+        .vprintf = (cp_stream_vprintf_t)cp_stream_fd_vprintf, \
+        .write = (cp_stream_write_t)cp_stream_fd_write, \
+        .reserve = (cp_stream_reserve_t)cp_stream_fd_reserve, \
+    })
+
 /**
  * Formatted printing into a stream.
  */
@@ -53,6 +61,50 @@ extern void cp_stream_fwrite(
     void const *buff,
     size_t size);
 
+/**
+ * Initialise a buffered file descriptor stream with a buffer of the
+ * given size.  The file descriptor is not closed by
+ * cp_stream_fd_fini().
+ */
+extern void cp_stream_fd_init(
+    cp_stream_fd_t *b,
+    int fd,
+    size_t buf_size);
+
+/**
+ * Flush the buffer, release the mapping and the buffer.  If less was
+ * written than announced by cp_stream_fd_reserve(), the file is
+ * truncated accordingly.
+ */
+extern void cp_stream_fd_fini(
+    cp_stream_fd_t *b);
+
+/**
+ * Write into a buffered file descriptor stream.
+ */
+extern void cp_stream_fd_write(
+    cp_stream_fd_t *b,
+    void const *buff,
+    size_t size);
+
+/**
+ * Formatted printing into a buffered file descriptor stream.
+ */
+CP_VPRINTF(2)
+extern void cp_stream_fd_vprintf(
+    cp_stream_fd_t *b,
+    char const *form,
+    va_list va);
+
+/**
+ * Prepare for writing exactly 'size' more bytes.  On regular files,
+ * that part of the file is mapped into memory and the data is written
+ * in place instead of via the buffer.  Otherwise, this does nothing.
+ */
+extern void cp_stream_fd_reserve(
+    cp_stream_fd_t *b,
+    size_t size);
+
 /**
  * Print into stream via va list
  */
@@ -76,4 +128,18 @@ static inline void cp_write(
     s->write(s->data, buff, size);
 }
 
+/**
+ * Announce that exactly 'size' more bytes will be written into the
+ * stream.  This is only a hint that the stream may use to prepare
+ * the output.
+ */
+static inline void cp_reserve(
+    cp_stream_t *s,
+    size_t size)
+{
+    if (s->reserve != NULL) {
+        s->reserve(s->data, size);
+    }
+}
+
 #endif /* CP_STREAM_H_ */
@@ -24,10 +24,50 @@ typedef void (*cp_stream_write_t)(
     void const *buff,
     size_t size);
 
+/**
+ * Announce that exactly 'size' more bytes will be written.
+ * This is optional, i.e., may be NULL in cp_stream_t.
+ */
+typedef void (*cp_stream_reserve_t)(
+    void *data,
+    size_t size);
+
 typedef struct {
     void *data;
     cp_stream_vprintf_t vprintf;
     cp_stream_write_t write;
+    cp_stream_reserve_t reserve;
 } cp_stream_t;
 
+/**
+ * Buffered output to a file descriptor.
+ *
+ * This collects output in a large buffer and flushes it with write(2).
+ * If the final size of the output is announced with cp_reserve() and
+ * the file descriptor is a regular file, that part of the file is
+ * mapped into memory and written in place.
+ */
+typedef struct {
+    int fd;
+
+    /** output buffer */
+    char *data;
+    size_t size;
+    size_t alloc;
+
+    /** memory mapped part of the file, or NULL */
+    char *map;
+    size_t map_pos;
+    size_t map_size;
+
+    /** file position of the start of the mapping */
+    size_t map_off;
+
+    /** number of bytes before the start of the mapping */
+    size_t map_skip;
+
+    /** number of bytes written so far */
+    size_t total;
+} cp_stream_fd_t;
+
 #endif /* CP_STREAM_TAM_H_ */
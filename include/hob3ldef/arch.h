@@ -14,6 +14,12 @@
 #  define CP_LL "ll"
 #  define CP_Z  "z"
 #  define cp_qsort_r qsort_r
+#  define CP_HAVE_MMAP 1
+#  define CP_HAVE_UNIX_SOCKET 1
+#endif
+
+#if defined(__linux__)
+#  define CP_HAVE_INOTIFY 1
 #endif
 
 #endif /* CP_ARCH_H_ */
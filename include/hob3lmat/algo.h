@@ -56,16 +56,21 @@ typedef struct {
  * General epsilon for comparisons.
  *
  * Typically the square of cp_pt_epsilon.
+ *
+ * Each thread has its own value, which starts as the default.  See
+ * cq_ctx_t for passing it to other threads.
  */
-extern double cp_eq_epsilon;
+extern _Thread_local double cp_eq_epsilon;
 
 /**
  * Epsilon for comparison of squared values, or two coordinates multiplied,
  * or determinants.
  *
  * Typically the square of cp_eq_epsilon.
+ *
+ * Each thread has its own value, like cp_eq_epsilon.
  */
-extern double cp_sqr_epsilon;
+extern _Thread_local double cp_sqr_epsilon;
 
 /**
  * Comparison using cp_eq_epsilon
@@ -17,6 +17,10 @@
 #define CQ_TRACE 0
 #endif
 
+#ifndef CQ_SWEEP_CNT
+#define CQ_SWEEP_CNT 0
+#endif
+
 /**
  * This uses integer coordinates throughout to try to handle mathematical
  * instabilities.  32-bit are used so that for multiplication, 64-bit
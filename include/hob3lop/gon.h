@@ -19,8 +19,23 @@
  *
  * This should not be optimised for exact 100th milimeter or 1000th
  * inch values, but for exact conversion to and from int.
+ *
+ * Each thread has its own value, which starts as the default.  See
+ * cq_ctx_t for passing it to other threads.
+ */
+extern _Thread_local double cq_dim_scale;
+
+/**
+ * Store the numeric context of the calling thread in 'c'.
+ */
+extern void cq_ctx_get(
+    cq_ctx_t *c);
+
+/**
+ * Set the numeric context of the calling thread from 'c'.
  */
-extern double cq_dim_scale;
+extern void cq_ctx_set(
+    cq_ctx_t const *c);
 
 /**
  * Convert v_vec2_t -> v_line2_t in place.
@@ -14,6 +14,28 @@
  */
 #define CQ_INT_DIG 30
 
+/**
+ * The numeric context of a thread: the grid for converting between
+ * double and int coordinates, and the epsilons for comparing doubles.
+ *
+ * Independent jobs can run on different threads with different
+ * contexts.  To continue a job on another thread, get the context on
+ * the original thread and set it on the other one.
+ */
+typedef struct {
+    /**
+     * The value of cq_dim_scale */
+    double dim_scale;
+
+    /**
+     * The value of cp_eq_epsilon */
+    double eq_epsilon;
+
+    /**
+     * The value of cp_sqr_epsilon */
+    double sqr_epsilon;
+} cq_ctx_t;
+
 #define CQ_VEC2_T \
     union { \
         cq_dim_t v[2]; \
@@ -29,6 +29,74 @@
  */
 typedef struct cq_sweep cq_sweep_t;
 
+/**
+ * Counters of the internal operations of a plane sweep, for tuning
+ * the algorithm.  Counting is compiled out unless CQ_SWEEP_CNT is 1
+ * (make SWEEPCNT=1), then all counters stay 0.
+ */
+typedef struct {
+    /**
+     * Insertions into and removals from the vertex agenda */
+    size_t vertex_insert;
+    size_t vertex_pop;
+
+    /**
+     * Insertions into and removals from the crossing agenda */
+    size_t xing_insert;
+    size_t xing_pop;
+
+    /**
+     * Calls of the comparison functions of the vertex agenda, the
+     * crossing agenda, the sweep line state (edges or bundles), and
+     * the result set */
+    size_t cmp_vertex;
+    size_t cmp_xing;
+    size_t cmp_state;
+    size_t cmp_result;
+
+    /**
+     * Comparisons of crossing coordinates that had to fall back to
+     * exact comparison of the fractional parts */
+    size_t cmp_exact;
+
+    /**
+     * Intersection tests of neighbouring edges in phase 1 */
+    size_t isect;
+
+    /**
+     * Bundle splits and joins in phase 2 */
+    size_t bundle_split;
+    size_t bundle_join;
+
+    /**
+     * Number of edges before and after snap rounding in phase 2 */
+    size_t snap_edge_in;
+    size_t snap_edge_out;
+
+    /**
+     * Edges visited by cq_sweep_reduce() and edges it kept */
+    size_t reduce_edge;
+    size_t reduce_keep;
+} cq_sweep_cnt_t;
+
+/**
+ * Statistics of cq_sweep_intersect(), see cq_sweep_stat_add().
+ */
+typedef struct {
+    /**
+     * Number of intersections found in phase 1 */
+    size_t xing_cnt;
+
+    /**
+     * Number of hot pixels visited by snap rounding in phase 2.  A
+     * pixel is counted once per pass. */
+    size_t pixel_cnt;
+
+    /**
+     * Internal counters, if compiled in */
+    cq_sweep_cnt_t cnt;
+} cq_sweep_stat_t;
+
 /**
  * Prepare a data structure for a plane sweep.
  * See cq_sweep_delete().
@@ -127,6 +195,16 @@ extern void cq_sweep_minmax(
 extern void cq_sweep_intersect(
     cq_sweep_t *sweep);
 
+/**
+ * Add the statistics of the cq_sweep_intersect() run on 'sweep' to 'r'.
+ *
+ * The internal counters in r->cnt cover all operations on 'sweep' so
+ * far, i.e., call this after cq_sweep_reduce() to include it.
+ */
+extern void cq_sweep_stat_add(
+    cq_sweep_stat_t *r,
+    cq_sweep_t const *sweep);
+
 /**
  * Use the output of cq_sweep_intersect() and filter it using a
  * boolean function.